@@ -0,0 +1,55 @@
+#include <iostream>
+#include <chrono>
+#include <sstream>
+#include "dictionary.h"
+#include "pattern_index.h"
+
+using Dictionary = Common::Dictionary<Crossword::PatternIndex>;
+
+// Reads one query per line from stdin: a pattern such as "c?t??n" or
+// "[bc]?t", optionally followed by the letters wildcards may take. All
+// queries are answered together as one batch, as for the slots of a grid.
+int main(int argc, char **argv) {
+    if (argc > 2) {
+        std::cerr << " Too many arguments provided" << std::endl;
+        std::cerr << " Usage: " << argv[0] << " [wordlist] < queries" << std::endl;
+        return 1;
+    }
+    Dictionary dictionary(argc == 2 ? argv[1] : Common::DEFAULT_WORDLIST);
+    if (!dictionary.isLoaded()) {
+        std::cerr << " Could not load the dictionary" << std::endl;
+        return 1;
+    }
+
+    vector<Crossword::Query> queries;
+    string line;
+    while (std::getline(std::cin, line)) {
+        std::istringstream ss(line);
+        Crossword::Query query;
+        if (!(ss >> query.pattern)) continue;
+        ss >> query.letters;
+        queries.push_back(query);
+    }
+
+    auto snapshot = dictionary.acquire();
+    vector<vector<string>> matches;
+    vector<bool> valid;
+    auto start = std::chrono::steady_clock::now();
+    snapshot->index().matchBatch(queries, matches, valid);
+    double elapsed = std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - start).count();
+
+    for (size_t i = 0; i < queries.size(); i++) {
+        std::cout << queries[i].pattern;
+        if (!queries[i].letters.empty()) std::cout << " " << queries[i].letters;
+        if (!valid[i]) {
+            std::cout << ": invalid pattern" << std::endl;
+            continue;
+        }
+        std::cout << ": " << matches[i].size() << " matches" << std::endl;
+        for (const auto& word : matches[i]) std::cout << " " << word << std::endl;
+    }
+    std::cout << "Answered " << queries.size() << " queries in " << elapsed <<
+        " us" << std::endl;
+    return 0;
+}
@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <map>
+#include "pattern_index.h"
+
+namespace Crossword {
+
+static constexpr uint32_t ALL_LETTERS = (1u << ALPHABET_SIZE) - 1;
+
+PatternIndex::PatternIndex(const vector<string>& words) {
+    for (const auto& word : words) {
+        if (buckets.size() <= word.length()) buckets.resize(word.length() + 1);
+        buckets[word.length()].words.push_back(word);
+    }
+    for (size_t length = 1; length < buckets.size(); length++) {
+        auto& bucket = buckets[length];
+        bucket.numBlocks = (bucket.words.size() + BLOCK_BITS - 1) / BLOCK_BITS;
+        bucket.bits.assign(length * ALPHABET_SIZE * bucket.numBlocks, 0);
+        for (size_t i = 0; i < bucket.words.size(); i++) {
+            const auto& word = bucket.words[i];
+            for (unsigned position = 0; position < length; position++) {
+                unsigned letter = word[position] - 'a';
+                size_t offset = (position * ALPHABET_SIZE + letter) * bucket.numBlocks;
+                bucket.bits[offset + i / BLOCK_BITS] |= Block(1) << (i % BLOCK_BITS);
+            }
+        }
+    }
+}
+
+bool PatternIndex::parseQuery(const Query& query,
+                              vector<uint32_t>& allowed) const {
+    allowed.clear();
+    uint32_t wildcardLetters = query.letters.empty() ? ALL_LETTERS : 0;
+    for (auto ch : query.letters) {
+        if (!isalpha(ch)) return false;
+        wildcardLetters |= 1u << (tolower(ch) - 'a');
+    }
+    const auto& pattern = query.pattern;
+    for (size_t i = 0; i < pattern.length(); i++) {
+        char ch = pattern[i];
+        if (ch == WILDCARD) {
+            allowed.push_back(wildcardLetters);
+        } else if (isalpha(ch)) {
+            allowed.push_back(1u << (tolower(ch) - 'a'));
+        } else if (ch == '[') {
+            uint32_t set = 0;
+            while (++i < pattern.length() && pattern[i] != ']') {
+                if (!isalpha(pattern[i])) return false;
+                set |= 1u << (tolower(pattern[i]) - 'a');
+            }
+            if (i == pattern.length() || set == 0) return false;
+            allowed.push_back(set);
+        } else {
+            return false;
+        }
+    }
+    return !allowed.empty();
+}
+
+void PatternIndex::intersect(const vector<uint32_t>& allowed,
+                             vector<Block>& result,
+                             vector<Block>& scratch) const {
+    const auto& bucket = buckets[allowed.size()];
+    const size_t numBlocks = bucket.numBlocks;
+    result.assign(numBlocks, ~Block(0));
+    if (bucket.words.size() % BLOCK_BITS != 0)
+        result.back() = (Block(1) << (bucket.words.size() % BLOCK_BITS)) - 1;
+    scratch.resize(numBlocks);
+    // The loops below are plain element-wise operations over contiguous
+    // blocks so the compiler can vectorize them.
+    Block* out = result.data();
+    Block* tmp = scratch.data();
+    for (unsigned position = 0; position < allowed.size(); position++) {
+        uint32_t letters = allowed[position];
+        if (letters == ALL_LETTERS) continue;
+        unsigned numLetters = __builtin_popcount(letters);
+        if (numLetters == 1) {
+            const Block* bits = bucket.bitset(position, __builtin_ctz(letters));
+            for (size_t b = 0; b < numBlocks; b++) out[b] &= bits[b];
+        } else if (numLetters <= ALPHABET_SIZE / 2) {
+            // Union of the allowed letters, then intersect.
+            std::fill(tmp, tmp + numBlocks, 0);
+            for (unsigned letter = 0; letter < ALPHABET_SIZE; letter++) {
+                if (!(letters & (1u << letter))) continue;
+                const Block* bits = bucket.bitset(position, letter);
+                for (size_t b = 0; b < numBlocks; b++) tmp[b] |= bits[b];
+            }
+            for (size_t b = 0; b < numBlocks; b++) out[b] &= tmp[b];
+        } else {
+            // Fewer letters are excluded than allowed: strip those out.
+            for (unsigned letter = 0; letter < ALPHABET_SIZE; letter++) {
+                if (letters & (1u << letter)) continue;
+                const Block* bits = bucket.bitset(position, letter);
+                for (size_t b = 0; b < numBlocks; b++) out[b] &= ~bits[b];
+            }
+        }
+    }
+}
+
+void PatternIndex::collect(size_t length, const vector<Block>& result,
+                           vector<string>& rv) const {
+    const auto& words = buckets[length].words;
+    for (size_t b = 0; b < result.size(); b++) {
+        for (Block bits = result[b]; bits != 0; bits &= bits - 1)
+            rv.push_back(words[b * BLOCK_BITS + __builtin_ctzll(bits)]);
+    }
+}
+
+bool PatternIndex::match(const Query& query, vector<string>& rv) const {
+    vector<uint32_t> allowed;
+    vector<Block> result, scratch;
+    rv.clear();
+    if (!parseQuery(query, allowed)) return false;
+    if (allowed.size() >= buckets.size()) return true;
+    intersect(allowed, result, scratch);
+    collect(allowed.size(), result, rv);
+    return true;
+}
+
+bool PatternIndex::count(const Query& query, size_t* rv) const {
+    vector<uint32_t> allowed;
+    vector<Block> result, scratch;
+    *rv = 0;
+    if (!parseQuery(query, allowed)) return false;
+    if (allowed.size() >= buckets.size()) return true;
+    intersect(allowed, result, scratch);
+    for (auto bits : result) *rv += __builtin_popcountll(bits);
+    return true;
+}
+
+void PatternIndex::matchBatch(const vector<Query>& queries,
+                              vector<vector<string>>& rv,
+                              vector<bool>& valid) const {
+    rv.assign(queries.size(), vector<string>());
+    valid.assign(queries.size(), true);
+    vector<uint32_t> allowed;
+    vector<Block> result, scratch;
+    // Slots in a grid often share a pattern, especially early in a fill.
+    std::map<pair<string, string>, size_t> seen;
+    for (size_t i = 0; i < queries.size(); i++) {
+        const auto& query = queries[i];
+        auto key = std::make_pair(query.pattern, query.letters);
+        auto found = seen.find(key);
+        if (found != seen.end()) {
+            rv[i] = rv[found->second];
+            valid[i] = valid[found->second];
+            continue;
+        }
+        seen.emplace(key, i);
+        if (!parseQuery(query, allowed)) {
+            valid[i] = false;
+            continue;
+        }
+        if (allowed.size() >= buckets.size()) continue;
+        intersect(allowed, result, scratch);
+        collect(allowed.size(), result, rv[i]);
+    }
+}
+
+}
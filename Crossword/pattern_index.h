@@ -0,0 +1,76 @@
+#ifndef PATTERN_INDEX_H_
+#define PATTERN_INDEX_H_
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace Crossword {
+
+static constexpr unsigned ALPHABET_SIZE = 26;
+static constexpr char WILDCARD = '?';
+
+// A fill query for one slot. pattern has one entry per square: a letter, the
+// WILDCARD, or a bracketed set such as "[aeiou]". If letters is non-empty,
+// every wildcard square is further restricted to those letters.
+struct Query {
+    string pattern;
+    string letters;
+};
+
+// Answers wildcard queries over a word list.
+//
+// Words are bucketed by length. For each length, position and letter there
+// is a bitset over the words of that length with that letter at that
+// position, so a query is the intersection of one bitset per constrained
+// square. Unconstrained squares cost nothing.
+class PatternIndex {
+    using Block = uint64_t;
+    static constexpr unsigned BLOCK_BITS = 64;
+
+    struct LengthBucket {
+        vector<string> words;
+        size_t numBlocks = 0;
+        // bits[(position * ALPHABET_SIZE + letter) * numBlocks + block]
+        vector<Block> bits;
+
+        const Block* bitset(unsigned position, unsigned letter) const {
+            return bits.data() +
+                (static_cast<size_t>(position) * ALPHABET_SIZE + letter) * numBlocks;
+        }
+    };
+
+    // buckets[n] = The words with n letters.
+    vector<LengthBucket> buckets;
+
+    // Fills allowed[i] with the 26-bit set of letters permitted in square i.
+    bool parseQuery(const Query& query, vector<uint32_t>& allowed) const;
+    // Leaves in result the words of length allowed.size() matching allowed.
+    void intersect(const vector<uint32_t>& allowed, vector<Block>& result,
+                   vector<Block>& scratch) const;
+    void collect(size_t length, const vector<Block>& result,
+                 vector<string>& rv) const;
+
+ public:
+    explicit PatternIndex(const vector<string>& words);
+
+    // Returns the matching words in sorted order. Returns false if the
+    // query is malformed.
+    bool match(const Query& query, vector<string>& rv) const;
+    bool count(const Query& query, size_t* rv) const;
+
+    // Answers many queries at once, e.g. every slot of a grid. Scratch space
+    // is shared between queries and identical queries are only run once.
+    // rv[i] holds the matches for queries[i], and valid[i] is false if
+    // queries[i] is malformed, so a typo is not mistaken for a slot with no
+    // fill.
+    void matchBatch(const vector<Query>& queries,
+                    vector<vector<string>>& rv, vector<bool>& valid) const;
+};
+
+}
+
+#endif  /* PATTERN_INDEX_H_ */
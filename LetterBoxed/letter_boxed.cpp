@@ -0,0 +1,154 @@
+#include <iostream>
+#include <map>
+#include <utility>
+#include "letter_boxed.h"
+
+namespace LetterBoxed {
+
+bool LetterBoxedSolver::parseBoard(const string& board) {
+    boardIndex.fill(-1);
+    unsigned count = 0;
+    unsigned sideLetters = 0;
+    for (auto ch : board) {
+        if (!isalpha(ch)) {
+            // Separators are optional, but if present they must fall
+            // between sides.
+            if (sideLetters != 0 && sideLetters != SIDE_SIZE) break;
+            sideLetters = 0;
+            continue;
+        }
+        unsigned letter = tolower(ch) - 'a';
+        if (count >= NUM_LETTERS) {
+            std::cerr << " More than " << NUM_LETTERS << " letters on the board" <<
+                std::endl;
+            return false;
+        }
+        if (boardIndex[letter] != -1) {
+            std::cerr << " Letter " << static_cast<char>(tolower(ch)) <<
+                " appears more than once on the board" << std::endl;
+            return false;
+        }
+        boardIndex[letter] = count++;
+        sideLetters = sideLetters % SIDE_SIZE + 1;
+    }
+    if (count != NUM_LETTERS || (sideLetters != 0 && sideLetters != SIDE_SIZE)) {
+        std::cerr << " The board needs " << NUM_SIDES << " sides of " <<
+            SIDE_SIZE << " letters each" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool LetterBoxedSolver::wordMask(const string& word, LetterMask* mask) const {
+    if (word.length() < MIN_WORD_LENGTH) return false;
+    LetterMask rv = 0;
+    int previousSide = -1;
+    for (auto ch : word) {
+        int index = boardIndex[ch - 'a'];
+        if (index == -1) return false;
+        // Consecutive letters must come from different sides.
+        int side = index / SIDE_SIZE;
+        if (side == previousSide) return false;
+        previousSide = side;
+        rv |= 1 << index;
+    }
+    *mask = rv;
+    return true;
+}
+
+LetterBoxedSolver::LetterBoxedSolver(const string& board,
+                                     const vector<string>& dictionary) {
+    saneBoard = parseBoard(board);
+    if (!saneBoard) return;
+    array<std::map<pair<LetterMask, unsigned>, size_t>, NUM_LETTERS> groupIndex;
+    for (const auto& word : dictionary) {
+        LetterMask mask;
+        if (!wordMask(word, &mask)) continue;
+        unsigned first = boardIndex[word.front() - 'a'];
+        unsigned last = boardIndex[word.back() - 'a'];
+        auto key = std::make_pair(mask, last);
+        auto found = groupIndex[first].find(key);
+        if (found == groupIndex[first].end()) {
+            found = groupIndex[first].emplace(key, buckets[first].size()).first;
+            buckets[first].push_back(WordGroup{mask, last, {}});
+        }
+        buckets[first][found->second].words.push_back(word);
+        playableWords++;
+    }
+}
+
+void LetterBoxedSolver::expand(const vector<const WordGroup*>& path,
+                               Solution& partial, vector<Solution>& rv,
+                               size_t limit) const {
+    if (rv.size() >= limit) return;
+    if (partial.size() == path.size()) {
+        rv.push_back(partial);
+        return;
+    }
+    for (const auto& word : path[partial.size()]->words) {
+        partial.push_back(word);
+        expand(path, partial, rv, limit);
+        partial.pop_back();
+    }
+}
+
+bool LetterBoxedSolver::search(LetterMask mask, unsigned last,
+                               unsigned wordsLeft,
+                               vector<const WordGroup*>& path,
+                               vector<uint8_t>& deadEnds,
+                               vector<Solution>& rv, size_t limit) const {
+    if (mask == FULL_MASK) {
+        // Covering the board early means a shorter solution exists, so this
+        // path is not one of exactly path.size() + wordsLeft words.
+        if (wordsLeft != 0) return false;
+        Solution partial;
+        expand(path, partial, rv, limit);
+        return true;
+    }
+    if (wordsLeft == 0) return false;
+    // deadEnds remembers states known to have no completion, so each
+    // (letters used, last letter, words left) state is explored once.
+    size_t key = (static_cast<size_t>(wordsLeft) * (FULL_MASK + 1) + mask) *
+        NUM_LETTERS + last;
+    if (deadEnds[key]) return false;
+    bool found = false;
+    for (const auto& group : buckets[last]) {
+        path.push_back(&group);
+        found |= search(mask | group.mask, group.last, wordsLeft - 1, path,
+                        deadEnds, rv, limit);
+        path.pop_back();
+        if (rv.size() >= limit) return true;
+    }
+    if (!found) deadEnds[key] = 1;
+    return found;
+}
+
+vector<Solution> LetterBoxedSolver::solve(unsigned numWords,
+                                          size_t limit) const {
+    vector<Solution> rv;
+    if (!saneBoard || numWords == 0) return rv;
+    vector<uint8_t> deadEnds(
+            static_cast<size_t>(numWords) * (FULL_MASK + 1) * NUM_LETTERS, 0);
+    vector<const WordGroup*> path;
+    for (unsigned first = 0; first < NUM_LETTERS; first++) {
+        for (const auto& group : buckets[first]) {
+            path.push_back(&group);
+            search(group.mask, group.last, numWords - 1, path, deadEnds, rv,
+                   limit);
+            path.pop_back();
+            if (rv.size() >= limit) return rv;
+        }
+    }
+    return rv;
+}
+
+vector<Solution> LetterBoxedSolver::solveMinimal(unsigned maxWords,
+                                                 size_t limit) const {
+    for (unsigned numWords = 1; numWords <= maxWords; numWords++) {
+        auto rv = solve(numWords, limit);
+        if (!rv.empty()) return rv;
+    }
+    return vector<Solution>();
+}
+
+}
@@ -0,0 +1,65 @@
+#ifndef LETTER_BOXED_H_
+#define LETTER_BOXED_H_
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace LetterBoxed {
+
+static constexpr unsigned NUM_SIDES = 4;
+static constexpr unsigned SIDE_SIZE = 3;
+static constexpr unsigned NUM_LETTERS = NUM_SIDES * SIDE_SIZE;
+static constexpr unsigned MIN_WORD_LENGTH = 3;
+static constexpr unsigned ALPHABET_SIZE = 26;
+
+// Bit i is set if the ith board letter is used.
+using LetterMask = uint16_t;
+static constexpr LetterMask FULL_MASK = (1 << NUM_LETTERS) - 1;
+
+using Solution = vector<string>;
+
+class LetterBoxedSolver {
+    // All playable words with the same first letter, last letter and set of
+    // letters are interchangeable for the search, so they are kept together.
+    struct WordGroup {
+        LetterMask mask;
+        unsigned last;
+        vector<string> words;
+    };
+
+    bool saneBoard = false;
+    // boardIndex[ch - 'a'] = Position of ch on the board, or -1 if absent.
+    array<int, ALPHABET_SIZE> boardIndex;
+    // buckets[i] = The groups of words starting with the ith board letter.
+    array<vector<WordGroup>, NUM_LETTERS> buckets;
+    size_t playableWords = 0;
+
+    bool parseBoard(const string& board);
+    bool wordMask(const string& word, LetterMask* mask) const;
+    bool search(LetterMask mask, unsigned last, unsigned wordsLeft,
+                vector<const WordGroup*>& path, vector<uint8_t>& deadEnds,
+                vector<Solution>& rv, size_t limit) const;
+    void expand(const vector<const WordGroup*>& path, Solution& partial,
+                vector<Solution>& rv, size_t limit) const;
+
+ public:
+    // board holds the four sides of three letters each, in order, separated
+    // by any non-letter characters, e.g. "abc-def-ghi-jkl".
+    explicit LetterBoxedSolver(const string& board,
+                               const vector<string>& dictionary);
+    bool isSaneBoard() const { return saneBoard; }
+    size_t numPlayableWords() const { return playableWords; }
+
+    // All solutions of exactly numWords words, up to limit of them.
+    vector<Solution> solve(unsigned numWords, size_t limit) const;
+    // All solutions using the fewest words possible, trying up to maxWords.
+    vector<Solution> solveMinimal(unsigned maxWords, size_t limit) const;
+};
+
+}
+
+#endif  /* LETTER_BOXED_H_ */
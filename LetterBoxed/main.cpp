@@ -0,0 +1,72 @@
+#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include "dictionary.h"
+#include "letter_boxed.h"
+
+static constexpr unsigned MAX_WORDS = 5;
+// Only caps the fallback search for longer solutions, whose count can grow
+// very large; one- and two-word solutions are always listed in full.
+static constexpr size_t MAX_LONGER_SOLUTIONS = 1000;
+
+static void printSolutions(const vector<LetterBoxed::Solution>& solutions) {
+    for (const auto& solution : solutions) {
+        std::cout << " ";
+        for (unsigned i = 0; i < solution.size(); i++) {
+            if (i != 0) std::cout << " - ";
+            std::cout << solution[i];
+        }
+        std::cout << std::endl;
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        std::cerr << " No board provided" << std::endl;
+        std::cerr << " Usage: " << argv[0] << " <abc-def-ghi-jkl> [wordlist]" << std::endl;
+        return 1;
+    }
+    if (argc > 3) {
+        std::cerr << " Too many arguments provided" << std::endl;
+        return 1;
+    }
+    vector<string> words;
+    if (!Common::loadWordList(argc == 3 ? argv[2] : Common::DEFAULT_WORDLIST, words))
+        return 1;
+
+    auto start = std::chrono::steady_clock::now();
+    LetterBoxed::LetterBoxedSolver solver(argv[1], words);
+    if (!solver.isSaneBoard()) {
+        std::cerr << " Invalid board" << std::endl;
+        return 1;
+    }
+    auto oneWord = solver.solve(1, SIZE_MAX);
+    auto twoWords = solver.solve(2, SIZE_MAX);
+    vector<LetterBoxed::Solution> longer;
+    bool truncated = false;
+    if (oneWord.empty() && twoWords.empty()) {
+        // Ask for one extra to tell whether the list was cut off.
+        longer = solver.solveMinimal(MAX_WORDS, MAX_LONGER_SOLUTIONS + 1);
+        truncated = longer.size() > MAX_LONGER_SOLUTIONS;
+        if (truncated) longer.resize(MAX_LONGER_SOLUTIONS);
+    }
+    double elapsed = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Playable words: " << solver.numPlayableWords() << std::endl;
+    std::cout << "One-word solutions: " << oneWord.size() << std::endl;
+    printSolutions(oneWord);
+    std::cout << "Two-word solutions: " << twoWords.size() << std::endl;
+    printSolutions(twoWords);
+    if (!longer.empty()) {
+        std::cout << longer.front().size() << "-word solutions: " <<
+            longer.size();
+        if (truncated) std::cout << " (truncated, more exist)";
+        std::cout << std::endl;
+        printSolutions(longer);
+    } else if (oneWord.empty() && twoWords.empty()) {
+        std::cout << "No solution with up to " << MAX_WORDS << " words" << std::endl;
+    }
+    std::cout << "Solved in " << elapsed << " ms" << std::endl;
+    return 0;
+}
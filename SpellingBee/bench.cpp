@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unistd.h>
+#include "spell_bee.h"
+
+// Benchmark driver for Spelling Bee. Every result is printed to stdout as one
+// JSON object per line so runs over different dictionary layouts or search
+// strategies can be diffed and plotted directly.
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr unsigned LOAD_RUNS = 5;
+static constexpr unsigned DEFAULT_RANDOM_PUZZLES = 200;
+static constexpr unsigned RANDOM_SEED = 2023;
+
+// Past puzzles; the first letter is the center letter.
+static const char* REAL_PUZZLES[] = {
+    "lacitpe", "gnoabri", "ymoltch", "rdiecnt", "ahnglki",
+    "ovtimal", "edfilnu", "bacrkoy", "wolnbdi", "pexlano",
+};
+
+static double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static long residentKb() {
+    std::ifstream statm("/proc/self/statm");
+    long size = 0, resident = 0;
+    if (!(statm >> size >> resident)) return -1;
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+static std::vector<std::string> randomPuzzles(unsigned count) {
+    std::mt19937 rng(RANDOM_SEED);
+    std::vector<std::string> rv;
+    std::string alphabet = "abcdefghijklmnopqrstuvwxyz";
+    for (unsigned i = 0; i < count; i++) {
+        std::shuffle(alphabet.begin(), alphabet.end(), rng);
+        rv.push_back(alphabet.substr(0, 7));
+    }
+    return rv;
+}
+
+static double percentile(std::vector<double> sorted, double p) {
+    if (sorted.empty()) return 0;
+    size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+    return sorted[index];
+}
+
+static void runQueries(const char* set, const std::vector<std::string>& puzzles,
+                       const SpellBee::Dictionary& dictionary) {
+    std::vector<double> latencies;
+    size_t totalWords = 0;
+    auto setStart = Clock::now();
+    for (const auto& puzzle : puzzles) {
+        std::vector<char> letters(puzzle.begin(), puzzle.end());
+        SpellBee::SpellingBee spellBee(letters, dictionary);
+        auto start = Clock::now();
+        auto words = spellBee.getAllWords();
+        double ms = elapsedMs(start);
+        latencies.push_back(ms);
+        totalWords += words.size();
+        std::cout << "{\"metric\":\"query\",\"set\":\"" << set <<
+            "\",\"letters\":\"" << puzzle << "\",\"words\":" << words.size() <<
+            ",\"ms\":" << ms << "}" << std::endl;
+    }
+    double totalMs = elapsedMs(setStart);
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << "{\"metric\":\"query_summary\",\"set\":\"" << set <<
+        "\",\"puzzles\":" << puzzles.size() << ",\"words\":" << totalWords <<
+        ",\"total_ms\":" << totalMs <<
+        ",\"min_ms\":" << percentile(latencies, 0) <<
+        ",\"p50_ms\":" << percentile(latencies, 0.5) <<
+        ",\"p95_ms\":" << percentile(latencies, 0.95) <<
+        ",\"max_ms\":" << percentile(latencies, 1) <<
+        ",\"queries_per_s\":" << (totalMs > 0 ? puzzles.size() * 1000.0 / totalMs : 0) <<
+        "}" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 3) {
+        std::cerr << " Usage: " << argv[0] << " [wordlist] [random puzzles]" << std::endl;
+        return 1;
+    }
+    std::string path = argc >= 2 ? argv[1] : Common::DEFAULT_WORDLIST;
+    unsigned randomCount = DEFAULT_RANDOM_PUZZLES;
+    if (argc == 3) {
+        char* end = nullptr;
+        errno = 0;
+        unsigned long count = strtoul(argv[2], &end, 10);
+        if (end == argv[2] || *end != '\0' || errno != 0 || count > UINT_MAX ||
+                argv[2][0] == '-') {
+            std::cerr << " Invalid number of random puzzles " << argv[2] << std::endl;
+            std::cerr << " Usage: " << argv[0] << " [wordlist] [random puzzles]" << std::endl;
+            return 1;
+        }
+        randomCount = count;
+    }
+
+    // Load time covers reading the file and building the trie.
+    std::vector<double> loadTimes;
+    for (unsigned i = 0; i < LOAD_RUNS; i++) {
+        auto start = Clock::now();
+        SpellBee::Dictionary dictionary(path);
+        loadTimes.push_back(elapsedMs(start));
+        if (!dictionary.isLoaded()) return 1;
+    }
+    std::sort(loadTimes.begin(), loadTimes.end());
+    std::cout << "{\"metric\":\"load\",\"runs\":" << LOAD_RUNS <<
+        ",\"min_ms\":" << loadTimes.front() <<
+        ",\"p50_ms\":" << percentile(loadTimes, 0.5) <<
+        ",\"max_ms\":" << loadTimes.back() << "}" << std::endl;
+
+    long rssBefore = residentKb();
+    SpellBee::Dictionary dictionary(path);
+    long rssAfter = residentKb();
+    auto snapshot = dictionary.acquire();
+    const auto& trie = snapshot->index();
+    std::cout << "{\"metric\":\"memory\",\"words\":" << snapshot->wordCount() <<
+        ",\"trie_nodes\":" << trie.nodeCount() <<
+        ",\"trie_bytes\":" << trie.nodeCount() * sizeof(SpellBee::TrieNode) <<
+        ",\"rss_delta_kb\":" << rssAfter - rssBefore <<
+        ",\"rss_kb\":" << rssAfter << "}" << std::endl;
+
+    std::vector<std::string> real(std::begin(REAL_PUZZLES), std::end(REAL_PUZZLES));
+    runQueries("real", real, dictionary);
+    runQueries("random", randomPuzzles(randomCount), dictionary);
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include <iostream>
+#include <string>
+#include "spell_bee.h"
+
+static bool parseLetters(const std::string& arg, std::vector<char>& input) {
+    input.clear();
+    for (auto ch : arg) {
+        if (!isalpha(ch)) {
+            std::cerr << " Invalid input: nonalphabetic character " << ch << " input." << std::endl;
+            return false;
+        }
+        input.push_back(tolower(ch));
+    }
+    if (input.size() != 7) {
+        std::cerr << " Exactly 7 characters required for spelling bee" <<
+            std::endl;
+        return false;
+    }
+    return true;
+}
+
+static void solve(std::vector<char>& input, const SpellBee::Dictionary& dictionary,
+                  bool printVersion) {
+    // Pin one snapshot so the reported version is the one that answered.
+    auto snapshot = dictionary.acquire();
+    if (printVersion) {
+        std::cout << "Dictionary version " << snapshot->version() << " (" <<
+            snapshot->wordCount() << " words)" << std::endl;
+    }
+    SpellBee::SpellingBee spellBee(input, dictionary);
+    auto words = spellBee.getAllWords(snapshot);
+    std::cout << "Number of words found: " << words.size() << std::endl;
+    unsigned totalScore = 0;
+    for (auto& word : words) {
+        auto thisWordScore = word.length();
+        if (word.length() >= input.size()) {
+            std::set<char> pangramCheck;
+            for (auto ch : word) pangramCheck.insert(ch);
+            if (pangramCheck.size() == input.size())
+                thisWordScore += input.size();
+        }
+        std::cout << " " << word << " (" << thisWordScore << ")" << std::endl;
+        totalScore += thisWordScore;
+    }
+    std::cout << "Total score: " << totalScore << std::endl;
+}
+
+// Reads one puzzle per line from stdin until EOF. A line reading "reload"
+// rebuilds the dictionary in the background while puzzles keep being
+// answered from the previous version.
+static int interactive(SpellBee::Dictionary& dictionary) {
+    std::string line;
+    std::vector<char> input;
+    while (std::getline(std::cin, line)) {
+        if (line.empty()) continue;
+        if (line == "reload") {
+            dictionary.reloadAsync();
+            continue;
+        }
+        if (!parseLetters(line, input)) continue;
+        solve(input, dictionary, true);
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        std::cerr << " Too few arguments provided" << std::endl;
+        std::cerr << " Usage: " << argv[0] << " <letters|-i> [wordlist]" << std::endl;
+        return 1;
+    }
+    if (argc > 3) {
+        std::cerr << " Too many arguments provided" << std::endl;
+        return 1;
+    }
+
+    std::vector<char> input;
+    std::string mode(argv[1]);
+    if (mode != "-i" && !parseLetters(mode, input)) return 1;
+
+    SpellBee::Dictionary dictionary(argc == 3 ? argv[2] : Common::DEFAULT_WORDLIST);
+    if (!dictionary.isLoaded()) {
+        std::cerr << " Could not load the dictionary" << std::endl;
+        return 1;
+    }
+    if (mode == "-i") return interactive(dictionary);
+    solve(input, dictionary, false);
+    return 0;
+}
@@ -0,0 +1,72 @@
+#ifndef SPELL_BEE_H_
+#define SPELL_BEE_H_
+
+#include <string.h>
+
+#include <string>
+#include <set>
+#include <vector>
+
+#include "dictionary.h"
+
+using namespace std;
+
+namespace SpellBee {
+
+#define ALPHABET_SIZE 26
+
+typedef struct trieNode TrieNode;
+
+struct trieNode {
+    bool validWord = false;
+    bool noFurtherWords = true;
+    TrieNode* nodeLetters[ALPHABET_SIZE];
+
+    trieNode() {
+        memset(nodeLetters, 0, sizeof(TrieNode*) * ALPHABET_SIZE);
+    }
+};
+
+class Trie {
+ private:
+    TrieNode* root;
+    size_t nodes = 1;
+
+    void insertWord(const string& word);
+    void freeNode(TrieNode* node);
+    void printTrie(std::string s, const TrieNode* node) const;
+
+ public:
+    explicit Trie(const std::vector<std::string>& words);
+    Trie(const Trie&) = delete;
+    Trie& operator=(const Trie&) = delete;
+    ~Trie() { freeNode(root); }
+
+    bool count(const std::string& str) const;
+    bool validPath(const std::string& s) const;
+    size_t nodeCount() const { return nodes; }
+};
+
+using Dictionary = Common::Dictionary<Trie>;
+
+class SpellingBee {
+ private:
+    static constexpr int MAX_LENGTH = 26;
+    const std::vector<char>& letters;
+    const Dictionary& dictionary;
+
+ public:
+    SpellingBee(std::vector<char>& l, const Dictionary& d)
+        : letters(l), dictionary(d) { }
+
+    // Runs against whichever dictionary snapshot is current when the call
+    // starts; a reload that lands mid-query does not affect the result.
+    set<string> getAllWords() const;
+    // Runs against the given snapshot, for callers that need to know which
+    // version answered.
+    set<string> getAllWords(const Dictionary::SnapshotPtr& snapshot) const;
+};
+
+}
+
+#endif  /* SPELL_BEE_H_ */
@@ -0,0 +1,102 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <thread>
+#include "dictionary.h"
+#include "wordle.h"
+
+static constexpr const char* PATTERN_CACHE = "wordle_patterns.bin";
+
+// Plays every word as the answer, spread across all cores, and prints the
+// distribution of guesses needed.
+static int simulate(const vector<string>& words,
+                    const Wordle::FeedbackMatrix& matrix,
+                    const Wordle::OpeningBook& book) {
+    auto start = std::chrono::steady_clock::now();
+    unsigned numThreads = std::max(1u, std::thread::hardware_concurrency());
+    vector<vector<unsigned>> histograms(numThreads);
+    vector<std::thread> threads;
+    for (unsigned t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t] {
+            Wordle::WordleSolver solver(words, matrix, &book);
+            auto& histogram = histograms[t];
+            for (unsigned answer = t; answer < words.size(); answer += numThreads) {
+                unsigned guesses = solver.play(answer);
+                if (histogram.size() <= guesses) histogram.resize(guesses + 1);
+                histogram[guesses]++;
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    vector<unsigned> total;
+    for (const auto& histogram : histograms) {
+        if (total.size() < histogram.size()) total.resize(histogram.size());
+        for (unsigned i = 0; i < histogram.size(); i++) total[i] += histogram[i];
+    }
+    double elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+
+    unsigned long totalGuesses = 0, failures = 0;
+    for (unsigned i = 1; i < total.size(); i++) {
+        std::cout << " " << i << " guesses: " << total[i] << std::endl;
+        totalGuesses += static_cast<unsigned long>(i) * total[i];
+        if (i > Wordle::MAX_GUESSES) failures += total[i];
+    }
+    std::cout << "Games: " << words.size() << ", average guesses: " <<
+        static_cast<double>(totalGuesses) / words.size() << ", failures: " <<
+        failures << ", time: " << elapsed << "s" << std::endl;
+    return 0;
+}
+
+// Suggests a guess, then reads the feedback for it from stdin ('g' green,
+// 'y' yellow, '.' gray, e.g. "g.y..") until solved.
+static int interactive(const vector<string>& words,
+                       const Wordle::FeedbackMatrix& matrix,
+                       const Wordle::OpeningBook& book) {
+    Wordle::WordleSolver solver(words, matrix, &book);
+    while (solver.remaining() > 0) {
+        unsigned guess = solver.bestGuess();
+        std::cout << "Guess: " << words[guess] << " (" << solver.remaining() <<
+            " candidates)" << std::endl;
+        string line;
+        Wordle::Pattern p;
+        do {
+            if (!std::getline(std::cin, line)) return 0;
+        } while (!Wordle::parsePattern(line, &p) &&
+                 (std::cerr << " Feedback must be 5 of g, y or ." << std::endl));
+        if (p == Wordle::ALL_GREEN) return 0;
+        solver.applyFeedback(guess, p);
+    }
+    std::cerr << " No word matches the feedback given" << std::endl;
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2 || argc > 3) {
+        std::cerr << " Usage: " << argv[0] << " <simulate|solve> [wordlist]" << std::endl;
+        return 1;
+    }
+    string mode(argv[1]);
+    if (mode != "simulate" && mode != "solve") {
+        std::cerr << " Unknown mode " << mode << std::endl;
+        return 1;
+    }
+
+    vector<string> allWords;
+    if (!Common::loadWordList(argc == 3 ? argv[2] : Common::DEFAULT_WORDLIST, allWords))
+        return 1;
+    auto words = Wordle::fiveLetterWords(allWords);
+    if (words.empty()) {
+        std::cerr << " No " << Wordle::WORD_LENGTH << "-letter words found" << std::endl;
+        return 1;
+    }
+    Wordle::FeedbackMatrix matrix(words, PATTERN_CACHE);
+    if (!matrix.isValid()) {
+        std::cerr << " Could not build the feedback matrix" << std::endl;
+        return 1;
+    }
+    // Shared by every solver, so the opening search runs once per process.
+    Wordle::OpeningBook book(words, matrix);
+    if (mode == "simulate") return simulate(words, matrix, book);
+    return interactive(words, matrix, book);
+}
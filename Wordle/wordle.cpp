@@ -0,0 +1,306 @@
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <cstring>
+#include "wordle.h"
+
+namespace Wordle {
+
+namespace {
+
+static constexpr char CACHE_MAGIC[8] = {'W', 'R', 'D', 'L', 'P', 'A', 'T', '1'};
+
+struct CacheHeader {
+    char magic[8];
+    uint64_t numWords;
+    uint64_t checksum;
+};
+
+// FNV-1a over the word list, so a cache built from a different list is never
+// reused.
+uint64_t wordListChecksum(const vector<string>& words) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (const auto& word : words) {
+        for (unsigned char ch : word) {
+            hash ^= ch;
+            hash *= 1099511628211ULL;
+        }
+        hash ^= '\n';
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+}
+
+Pattern computePattern(const string& guess, const string& answer) {
+    array<unsigned, WORD_LENGTH> marks;
+    array<unsigned, 26> unmatched;
+    unmatched.fill(0);
+    for (unsigned i = 0; i < WORD_LENGTH; i++) {
+        if (guess[i] == answer[i]) {
+            marks[i] = GREEN;
+        } else {
+            marks[i] = GRAY;
+            unmatched[answer[i] - 'a']++;
+        }
+    }
+    // Yellows are handed out left to right, at most once per unmatched letter
+    // of the answer.
+    for (unsigned i = 0; i < WORD_LENGTH; i++) {
+        if (marks[i] == GREEN) continue;
+        unsigned index = guess[i] - 'a';
+        if (unmatched[index] == 0) continue;
+        unmatched[index]--;
+        marks[i] = YELLOW;
+    }
+    Pattern rv = 0;
+    for (unsigned i = WORD_LENGTH; i-- > 0;) rv = rv * 3 + marks[i];
+    return rv;
+}
+
+string patternToString(Pattern p) {
+    string rv;
+    for (unsigned i = 0; i < WORD_LENGTH; i++) {
+        unsigned mark = p % 3;
+        p /= 3;
+        rv += mark == GREEN ? 'g' : mark == YELLOW ? 'y' : '.';
+    }
+    return rv;
+}
+
+bool parsePattern(const string& s, Pattern* p) {
+    if (s.length() != WORD_LENGTH) return false;
+    unsigned rv = 0;
+    for (unsigned i = WORD_LENGTH; i-- > 0;) {
+        unsigned mark;
+        switch (tolower(s[i])) {
+            case 'g': mark = GREEN; break;
+            case 'y': mark = YELLOW; break;
+            case '.': mark = GRAY; break;
+            default: return false;
+        }
+        rv = rv * 3 + mark;
+    }
+    *p = rv;
+    return true;
+}
+
+vector<string> fiveLetterWords(const vector<string>& words) {
+    vector<string> rv;
+    for (const auto& word : words) {
+        if (word.length() == WORD_LENGTH) rv.push_back(word);
+    }
+    std::sort(rv.begin(), rv.end());
+    return rv;
+}
+
+FeedbackMatrix::FeedbackMatrix(const vector<string>& words,
+                               const string& cachePath)
+    : numWords(words.size()) {
+    uint64_t checksum = wordListChecksum(words);
+    if (openCache(cachePath, checksum)) return;
+    if (createCache(cachePath, checksum, words)) return;
+    std::cerr << " Cannot write pattern cache " << cachePath <<
+        ", keeping patterns in memory" << std::endl;
+    mappingSize = numWords * numWords;
+    if (mappingSize == 0) return;
+    mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        return;
+    }
+    fill(static_cast<Pattern*>(mapping), words);
+    patterns = static_cast<const Pattern*>(mapping);
+}
+
+FeedbackMatrix::~FeedbackMatrix() {
+    if (mapping != nullptr) munmap(mapping, mappingSize);
+}
+
+void FeedbackMatrix::fill(Pattern* out, const vector<string>& words) const {
+    for (size_t g = 0; g < numWords; g++) {
+        for (size_t a = 0; a < numWords; a++) {
+            out[g * numWords + a] = computePattern(words[g], words[a]);
+        }
+    }
+}
+
+bool FeedbackMatrix::openCache(const string& cachePath, uint64_t checksum) {
+    int fd = open(cachePath.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    size_t expected = sizeof(CacheHeader) + numWords * numWords;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) != expected) {
+        close(fd);
+        return false;
+    }
+    void* m = mmap(nullptr, expected, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (m == MAP_FAILED) return false;
+    const CacheHeader* header = static_cast<const CacheHeader*>(m);
+    if (memcmp(header->magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 ||
+            header->numWords != numWords || header->checksum != checksum) {
+        munmap(m, expected);
+        return false;
+    }
+    mapping = m;
+    mappingSize = expected;
+    patterns = reinterpret_cast<const Pattern*>(
+            static_cast<const char*>(m) + sizeof(CacheHeader));
+    return true;
+}
+
+bool FeedbackMatrix::createCache(const string& cachePath, uint64_t checksum,
+                                 const vector<string>& words) {
+    // Build under a temporary name unique to this call and rename it into
+    // place only once it is fully written. Concurrent builders each fill
+    // their own file, and readers never map a half-written one; the last
+    // rename wins, and every builder's file holds the same patterns.
+    string tmpTemplate = cachePath + ".XXXXXX";
+    vector<char> tmpName(tmpTemplate.begin(), tmpTemplate.end());
+    tmpName.push_back('\0');
+    int fd = mkstemp(tmpName.data());
+    if (fd < 0) return false;
+    string tmpPath(tmpName.data());
+    size_t total = sizeof(CacheHeader) + numWords * numWords;
+    // mkstemp creates the file owner-only; match an ordinary cache file.
+    if (fchmod(fd, 0644) != 0 || ftruncate(fd, total) != 0) {
+        close(fd);
+        unlink(tmpPath.c_str());
+        return false;
+    }
+    void* m = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (m == MAP_FAILED) {
+        unlink(tmpPath.c_str());
+        return false;
+    }
+    CacheHeader* header = static_cast<CacheHeader*>(m);
+    memcpy(header->magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header->numWords = numWords;
+    header->checksum = checksum;
+    Pattern* out = reinterpret_cast<Pattern*>(
+            static_cast<char*>(m) + sizeof(CacheHeader));
+    fill(out, words);
+    if (msync(m, total, MS_SYNC) != 0 ||
+            rename(tmpPath.c_str(), cachePath.c_str()) != 0) {
+        munmap(m, total);
+        unlink(tmpPath.c_str());
+        return false;
+    }
+    mapping = m;
+    mappingSize = total;
+    patterns = out;
+    return true;
+}
+
+WordleSolver::WordleSolver(const vector<string>& w, const FeedbackMatrix& m,
+                           const OpeningBook* b)
+    : words(w), matrix(m), book(b) {
+    if (words.size() != matrix.size()) {
+        throw std::runtime_error("Feedback matrix does not match word list");
+    }
+    reset();
+}
+
+OpeningBook::OpeningBook(const vector<string>& words,
+                         const FeedbackMatrix& matrix) {
+    WordleSolver solver(words, matrix);
+    openingGuess = solver.searchBestGuess();
+    for (unsigned p = 0; p < NUM_PATTERNS; p++) {
+        solver.reset();
+        solver.applyFeedback(openingGuess, p);
+        secondGuesses[p] = solver.remaining() == 0 ?
+            words.size() : solver.searchBestGuess();
+    }
+}
+
+void WordleSolver::reset() {
+    alive.assign(words.size(), 1);
+    candidates.resize(words.size());
+    for (unsigned i = 0; i < candidates.size(); i++) candidates[i] = i;
+    afterOpening = false;
+}
+
+uint64_t WordleSolver::scoreGuess(unsigned guess) const {
+    // Sum of squared bucket sizes, i.e. the expected number of remaining
+    // candidates scaled by the current candidate count.
+    array<uint32_t, NUM_PATTERNS> buckets;
+    buckets.fill(0);
+    const Pattern* row = matrix.row(guess);
+    if (candidates.size() == words.size()) {
+        // Every word is still a candidate: stream the row contiguously.
+        for (size_t i = 0; i < words.size(); i++) buckets[row[i]]++;
+    } else {
+        for (auto c : candidates) buckets[row[c]]++;
+    }
+    uint64_t rv = 0;
+    for (auto count : buckets) rv += static_cast<uint64_t>(count) * count;
+    return rv;
+}
+
+unsigned WordleSolver::searchBestGuess() const {
+    if (candidates.size() <= 2) return candidates.front();
+    unsigned rv = candidates.front();
+    uint64_t bestScore = scoreGuess(rv);
+    for (unsigned g = 0; g < words.size(); g++) {
+        uint64_t score = scoreGuess(g);
+        // Prefer a guess that could itself be the answer when it does no
+        // worse.
+        if (score < bestScore ||
+                (score == bestScore && alive[g] && !alive[rv])) {
+            bestScore = score;
+            rv = g;
+        }
+    }
+    return rv;
+}
+
+unsigned WordleSolver::bestGuess() {
+    if (candidates.empty()) return words.size();
+    if (book == nullptr) return searchBestGuess();
+    if (candidates.size() == words.size()) return book->opening();
+    if (afterOpening) return book->second(openingFeedback);
+    return searchBestGuess();
+}
+
+void WordleSolver::applyFeedback(unsigned guess, Pattern p) {
+    afterOpening = book != nullptr && candidates.size() == words.size() &&
+        guess == book->opening();
+    openingFeedback = p;
+    // Filter with one contiguous pass over the whole row and the alive
+    // mask; both are byte arrays, so this compiles to vector compares.
+    const Pattern* row = matrix.row(guess);
+    uint8_t* mask = alive.data();
+    const size_t n = words.size();
+    for (size_t i = 0; i < n; i++) mask[i] &= row[i] == p;
+    // Then rebuild the candidate list once for the scoring passes.
+    size_t kept = 0;
+    for (auto c : candidates) {
+        candidates[kept] = c;
+        kept += mask[c];
+    }
+    candidates.resize(kept);
+}
+
+unsigned WordleSolver::play(unsigned answer) {
+    reset();
+    unsigned guesses = 0;
+    while (!candidates.empty()) {
+        unsigned guess = bestGuess();
+        guesses++;
+        Pattern p = matrix.get(guess, answer);
+        if (p == ALL_GREEN) return guesses;
+        applyFeedback(guess, p);
+    }
+    throw std::runtime_error("Answer eliminated from its own candidates");
+}
+
+}
@@ -0,0 +1,123 @@
+#ifndef WORDLE_H_
+#define WORDLE_H_
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace Wordle {
+
+static constexpr unsigned WORD_LENGTH = 5;
+static constexpr unsigned MAX_GUESSES = 6;
+
+// Feedback for one guess against one answer, packed base 3 into a byte:
+// digit i (least significant first) is GRAY, YELLOW or GREEN for letter i.
+using Pattern = uint8_t;
+static constexpr unsigned GRAY = 0;
+static constexpr unsigned YELLOW = 1;
+static constexpr unsigned GREEN = 2;
+static constexpr unsigned NUM_PATTERNS = 243;  // 3^WORD_LENGTH
+static constexpr Pattern ALL_GREEN = NUM_PATTERNS - 1;
+
+Pattern computePattern(const string& guess, const string& answer);
+// Patterns are written as one character per letter: 'g' green, 'y' yellow,
+// '.' gray.
+string patternToString(Pattern p);
+bool parsePattern(const string& s, Pattern* p);
+
+// Returns the sorted WORD_LENGTH-letter words in words.
+vector<string> fiveLetterWords(const vector<string>& words);
+
+// The guess x answer feedback matrix over one word list, one byte per pair.
+//
+// Computing patterns on the fly dominates simulation time, so the full matrix
+// is built once and kept in a memory-mapped cache file. The file is tagged
+// with a checksum of the word list and rebuilt if the list changes. If the
+// cache cannot be written the matrix lives in anonymous memory instead.
+class FeedbackMatrix {
+    size_t numWords = 0;
+    void* mapping = nullptr;
+    size_t mappingSize = 0;
+    const Pattern* patterns = nullptr;
+
+    bool openCache(const string& cachePath, uint64_t checksum);
+    bool createCache(const string& cachePath, uint64_t checksum,
+                     const vector<string>& words);
+    void fill(Pattern* out, const vector<string>& words) const;
+
+ public:
+    explicit FeedbackMatrix(const vector<string>& words,
+                            const string& cachePath);
+    FeedbackMatrix(const FeedbackMatrix&) = delete;
+    FeedbackMatrix& operator=(const FeedbackMatrix&) = delete;
+    ~FeedbackMatrix();
+
+    bool isValid() const { return patterns != nullptr; }
+    size_t size() const { return numWords; }
+    const Pattern* row(unsigned guess) const {
+        return patterns + static_cast<size_t>(guess) * numWords;
+    }
+    Pattern get(unsigned guess, unsigned answer) const {
+        return row(guess)[answer];
+    }
+};
+
+class OpeningBook;
+
+// Plays one game at a time, always guessing the word that minimizes the
+// expected number of remaining candidates. Any word may be guessed; every
+// word is a possible answer.
+class WordleSolver {
+    const vector<string>& words;
+    const FeedbackMatrix& matrix;
+    // alive[i] = 1 iff word i is still consistent with all feedback so far;
+    // candidates lists the same words by index.
+    vector<uint8_t> alive;
+    vector<unsigned> candidates;
+    // Precomputed first and second guesses, or nullptr to search every time.
+    const OpeningBook* book;
+    bool afterOpening = false;
+    Pattern openingFeedback = 0;
+
+    uint64_t scoreGuess(unsigned guess) const;
+
+ public:
+    explicit WordleSolver(const vector<string>& w, const FeedbackMatrix& m,
+                          const OpeningBook* b = nullptr);
+
+    // Searches every word for the best next guess, ignoring the book.
+    unsigned searchBestGuess() const;
+
+    void reset();
+    unsigned bestGuess();
+    void applyFeedback(unsigned guess, Pattern p);
+    size_t remaining() const { return candidates.size(); }
+    const vector<unsigned>& getCandidates() const { return candidates; }
+
+    // Plays a full game against answer and returns the number of guesses
+    // used. Games are played to the end, so this may exceed MAX_GUESSES.
+    unsigned play(unsigned answer);
+};
+
+// The opening guess and the best reply to each possible feedback on it only
+// depend on the word list, so they are computed once and shared read-only by
+// every solver, e.g. one per simulation thread.
+class OpeningBook {
+    unsigned openingGuess;
+    // secondGuesses[p] = Best guess after feedback p on the opening, or the
+    // number of words if no answer gives that feedback.
+    array<unsigned, NUM_PATTERNS> secondGuesses;
+
+ public:
+    explicit OpeningBook(const vector<string>& words,
+                         const FeedbackMatrix& matrix);
+    unsigned opening() const { return openingGuess; }
+    unsigned second(Pattern p) const { return secondGuesses[p]; }
+};
+
+}
+
+#endif  /* WORDLE_H_ */
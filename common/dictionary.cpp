@@ -0,0 +1,41 @@
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include "dictionary.h"
+
+namespace Common {
+
+bool loadWordList(const std::string& path, std::vector<std::string>& words) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << " Cannot find " << path << std::endl;
+        return false;
+    }
+    std::vector<std::string> loaded;
+    std::string word;
+    while (file >> word) {
+        bool someNonAlpha = std::any_of(word.begin(), word.end(),
+                [](unsigned char c) { return !isalpha(c); } );
+        if (someNonAlpha) continue;
+        std::transform(word.begin(), word.end(), word.begin(),
+                [](unsigned char c) { return tolower(c); } );
+        loaded.push_back(word);
+    }
+    // A read error (e.g. path is a directory) or a list with no usable words
+    // is a failed load, so a file caught mid-rewrite never replaces a good
+    // dictionary with an empty one.
+    if (file.bad()) {
+        std::cerr << " Error reading " << path << std::endl;
+        return false;
+    }
+    if (loaded.empty()) {
+        std::cerr << " No words found in " << path << std::endl;
+        return false;
+    }
+    std::sort(loaded.begin(), loaded.end());
+    loaded.erase(std::unique(loaded.begin(), loaded.end()), loaded.end());
+    words.swap(loaded);
+    return true;
+}
+
+}
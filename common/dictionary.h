@@ -0,0 +1,151 @@
+#ifndef COMMON_DICTIONARY_H_
+#define COMMON_DICTIONARY_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Common {
+
+static constexpr const char* DEFAULT_WORDLIST = "../common/wordlist/wordlist.txt";
+
+// Reads every purely alphabetic word from the file at path, lowercased,
+// sorted and deduplicated. Returns false, leaving words untouched, if the
+// file cannot be opened or read or holds no such words.
+bool loadWordList(const std::string& path, std::vector<std::string>& words);
+
+// An immutable, versioned view of one load of the word list. Index is the
+// lookup structure built over the words (e.g. a trie) and must be
+// constructible from a const std::vector<std::string>&.
+template<typename Index>
+class DictionarySnapshot {
+    uint64_t version_i;
+    std::string path_i;
+    size_t wordCount_i;
+    Index index_i;
+
+ public:
+    explicit DictionarySnapshot(uint64_t v, const std::string& p,
+                                const std::vector<std::string>& words)
+        : version_i(v), path_i(p), wordCount_i(words.size()), index_i(words) { }
+    DictionarySnapshot(const DictionarySnapshot&) = delete;
+    DictionarySnapshot& operator=(const DictionarySnapshot&) = delete;
+
+    uint64_t version() const { return version_i; }
+    const std::string& path() const { return path_i; }
+    size_t wordCount() const { return wordCount_i; }
+    const Index& index() const { return index_i; }
+};
+
+// Holds the current DictionarySnapshot and swaps in new ones on reload.
+//
+// Readers call acquire() and keep the returned pointer for the duration of a
+// query, so they never see a partially built index. A reload builds the new
+// snapshot off to the side, without holding anything readers use, and then
+// publishes it with std::atomic_store on the shared_ptr. The previous
+// snapshot is freed once its last reader lets go of it.
+//
+// This is not lock-free: libstdc++ implements the shared_ptr atomic_load and
+// atomic_store overloads with a small pool of global mutexes. A reader holds
+// one only while copying the pointer and bumping the reference count, and the
+// writer holds it only for the pointer swap, so a reader can wait at most for
+// that swap, never for a rebuild.
+template<typename Index>
+class Dictionary {
+ public:
+    using SnapshotPtr = std::shared_ptr<const DictionarySnapshot<Index>>;
+
+ private:
+    SnapshotPtr current;
+    // Serializes reloads against each other. Readers never take it.
+    std::mutex reloadMutex;
+    std::string path;
+    uint64_t lastVersion = 0;
+    // Guards the background reloader. reloadPending is set by reloadAsync()
+    // and consumed by the reloader thread, which keeps going while requests
+    // arrive, so callers never wait on a rebuild in progress.
+    std::mutex reloaderMutex;
+    std::thread reloader;
+    bool reloaderRunning = false;
+    bool reloadPending = false;
+
+    void runReloads() {
+        while (true) {
+            {
+                std::lock_guard<std::mutex> guard(reloaderMutex);
+                if (!reloadPending) {
+                    reloaderRunning = false;
+                    return;
+                }
+                reloadPending = false;
+            }
+            reload();
+        }
+    }
+
+    bool publish(const std::string& newPath) {
+        std::vector<std::string> words;
+        if (!loadWordList(newPath, words)) return false;
+        SnapshotPtr next = std::make_shared<const DictionarySnapshot<Index>>(
+                lastVersion + 1, newPath, words);
+        std::atomic_store(&current, next);
+        lastVersion++;
+        path = newPath;
+        return true;
+    }
+
+ public:
+    explicit Dictionary(const std::string& p = DEFAULT_WORDLIST) : path(p) {
+        reload();
+    }
+    Dictionary(const Dictionary&) = delete;
+    Dictionary& operator=(const Dictionary&) = delete;
+    ~Dictionary() { waitForReload(); }
+
+    // Returns the snapshot in use right now, or nullptr if no load has ever
+    // succeeded. Briefly locks to copy the pointer; see the class comment.
+    SnapshotPtr acquire() const { return std::atomic_load(&current); }
+    bool isLoaded() const { return acquire() != nullptr; }
+
+    // Rebuilds from the current path (or from newPath, which then becomes the
+    // current path) and publishes the result. On failure the previous
+    // snapshot stays in place and false is returned.
+    bool reload() {
+        std::lock_guard<std::mutex> guard(reloadMutex);
+        return publish(path);
+    }
+    bool reload(const std::string& newPath) {
+        std::lock_guard<std::mutex> guard(reloadMutex);
+        return publish(newPath);
+    }
+
+    // Same as reload(), but runs on a background thread so the caller can
+    // keep serving queries from the old snapshot in the meantime. Requests
+    // made while a reload is running are coalesced into one more reload once
+    // it finishes.
+    void reloadAsync() {
+        std::lock_guard<std::mutex> guard(reloaderMutex);
+        reloadPending = true;
+        if (reloaderRunning) return;
+        // Any previous reloader has already finished, so this does not wait.
+        if (reloader.joinable()) reloader.join();
+        reloaderRunning = true;
+        reloader = std::thread([this] { runReloads(); });
+    }
+    void waitForReload() {
+        std::thread finishing;
+        {
+            std::lock_guard<std::mutex> guard(reloaderMutex);
+            finishing = std::move(reloader);
+        }
+        if (finishing.joinable()) finishing.join();
+    }
+};
+
+}
+
+#endif  /* COMMON_DICTIONARY_H_ */